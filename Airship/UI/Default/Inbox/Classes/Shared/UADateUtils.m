@@ -28,24 +28,38 @@
 
 @implementation UADateUtils
 
++ (NSDateFormatter *)formatterWithLocale:(NSLocale *)locale {
+    NSDateFormatter *formatter = [[NSDateFormatter alloc] init];
+    [formatter setLocale:locale];
+    [formatter setTimeStyle:NSDateFormatterFullStyle];
+    return formatter;
+}
+
 + (NSString *)formattedDateRelativeToNow:(NSDate *)date {
 
-    // shared locale object
-    NSLocale *enUSPOSIXLocale = [[NSLocale alloc] initWithLocaleIdentifier:@"en_US_POSIX"];
+    // Formatters are expensive to create and this is called for every
+    // message list cell, so build them once and reuse them (main thread only)
+    static NSDateFormatter *mdf = nil;
+    static NSDateFormatter *dateFormatter = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        // shared locale object
+        NSLocale *enUSPOSIXLocale = [[NSLocale alloc] initWithLocaleIdentifier:@"en_US_POSIX"];
+
+        mdf = [self formatterWithLocale:enUSPOSIXLocale];
+        [mdf setDateFormat:@"yyyy-MM-dd"];
+
+        dateFormatter = [self formatterWithLocale:enUSPOSIXLocale];
+    });
 
-    NSDateFormatter* mdf = [[NSDateFormatter alloc] init];
-    [mdf setLocale:enUSPOSIXLocale];
-    [mdf setTimeStyle:NSDateFormatterFullStyle];
-    [mdf setTimeZone:[NSTimeZone localTimeZone]];
-    [mdf setDateFormat:@"yyyy-MM-dd"];
+    // pick up time zone changes made while the app is running
+    NSTimeZone *localTimeZone = [NSTimeZone localTimeZone];
+    [mdf setTimeZone:localTimeZone];
+    [dateFormatter setTimeZone:localTimeZone];
 
     NSDate *midnight = [mdf dateFromString:[mdf stringFromDate:date]];
 
     NSInteger dayDiff = (int)[midnight timeIntervalSinceNow] / (60*60*24);
-    NSDateFormatter *dateFormatter = [[NSDateFormatter alloc] init];
-    [dateFormatter setLocale:enUSPOSIXLocale];
-    [dateFormatter setTimeStyle:NSDateFormatterFullStyle];
-    [dateFormatter setTimeZone:[NSTimeZone localTimeZone]];
 
     // TODO: format string for localization
     if(dayDiff == 0)
@@ -256,21 +256,16 @@
 
 - (NSUInteger)countOfUnreadMessagesInSetOfIndexPaths:(NSSet *)set {
     NSUInteger count = 0;
-    BOOL isMarkedUnread = NO;
     for (NSIndexPath *path in set) {
-        isMarkedUnread = [self checkSetOfIndexPaths:self.setOfUnreadMessagesInSelection forIndexPath:path];
-        if(isMarkedUnread) count++;
+        if ([self.setOfUnreadMessagesInSelection containsObject:path]) count++;
     }
     return count;
 }
 
 - (BOOL)checkSetOfIndexPaths:(NSSet *)setOfPaths forIndexPath:(NSIndexPath *)indexPath {
-    for (NSIndexPath *path in setOfPaths) {
-        if ([path compare:indexPath] == NSOrderedSame) {
-            return YES;
-        };
-    }
-    return NO;
+    // NSIndexPath hashes by value, so this is a constant time lookup
+    // rather than a scan of every selected row
+    return [setOfPaths containsObject:indexPath];
 }
 
 #pragma mark -